@@ -0,0 +1,16 @@
+/* Autogenerated by waf */
+#define SAMBA_VERSION_MAJOR 4
+#define SAMBA_VERSION_MINOR 9
+#define SAMBA_VERSION_RELEASE 0
+#define SAMBA_VERSION_PRE_RELEASE 1
+#define SAMBA_VERSION_SUFFIX "DEVELOPERBUILD"
+#define SAMBA_VERSION_OFFICIAL_STRING "4.9.0pre1-DEVELOPERBUILD"
+
+#ifdef SAMBA_VERSION_VENDOR_FUNCTION
+#  define SAMBA_VERSION_STRING SAMBA_VERSION_VENDOR_FUNCTION
+#else /* SAMBA_VERSION_VENDOR_FUNCTION */
+#  define SAMBA_VERSION_STRING "4.9.0pre1-DEVELOPERBUILD"
+#endif
+/* Version for mkrelease.sh: 
+SAMBA_VERSION_STRING=4.9.0pre1-DEVELOPERBUILD
+ */
@@ -0,0 +1,4 @@
+#define LDB_VERSION "1.3.3"
+#define LDB_VERSION_MAJOR 1
+#define LDB_VERSION_MINOR 3
+#define LDB_VERSION_RELEASE 3
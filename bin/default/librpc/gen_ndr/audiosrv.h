@@ -0,0 +1,89 @@
+/* header auto-generated by pidl */
+
+#ifndef _PIDL_HEADER_audiosrv
+#define _PIDL_HEADER_audiosrv
+
+#include <stdint.h>
+
+#include "libcli/util/ntstatus.h"
+
+#ifndef _HEADER_audiosrv
+#define _HEADER_audiosrv
+
+
+struct audiosrv_CreatezoneFactoriesList {
+	int _dummy_element;
+};
+
+
+struct audiosrv_CreateGfxFactoriesList {
+	int _dummy_element;
+};
+
+
+struct audiosrv_CreateGfxList {
+	int _dummy_element;
+};
+
+
+struct audiosrv_RemoveGfx {
+	int _dummy_element;
+};
+
+
+struct audiosrv_AddGfx {
+	int _dummy_element;
+};
+
+
+struct audiosrv_ModifyGfx {
+	int _dummy_element;
+};
+
+
+struct audiosrv_OpenGfx {
+	int _dummy_element;
+};
+
+
+struct audiosrv_Logon {
+	int _dummy_element;
+};
+
+
+struct audiosrv_Logoff {
+	int _dummy_element;
+};
+
+
+struct audiosrv_RegisterSessionNotificationEvent {
+	int _dummy_element;
+};
+
+
+struct audiosrv_UnregisterSessionNotificationEvent {
+	int _dummy_element;
+};
+
+
+struct audiosrv_SessionConnectState {
+	int _dummy_element;
+};
+
+
+struct audiosrv_DriverOpenDrvRegKey {
+	int _dummy_element;
+};
+
+
+struct audiosrv_AdvisePreferredDeviceChange {
+	int _dummy_element;
+};
+
+
+struct audiosrv_GetPnpInfo {
+	int _dummy_element;
+};
+
+#endif /* _HEADER_audiosrv */
+#endif /* _PIDL_HEADER_audiosrv */
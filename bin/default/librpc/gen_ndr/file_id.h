@@ -0,0 +1,20 @@
+/* header auto-generated by pidl */
+
+#ifndef _PIDL_HEADER_file_id
+#define _PIDL_HEADER_file_id
+
+#include <stdint.h>
+
+#include "libcli/util/ntstatus.h"
+
+#ifndef _HEADER_file_id
+#define _HEADER_file_id
+
+struct file_id {
+	uint64_t devid;
+	uint64_t inode;
+	uint64_t extid;
+}/* [public] */;
+
+#endif /* _HEADER_file_id */
+#endif /* _PIDL_HEADER_file_id */
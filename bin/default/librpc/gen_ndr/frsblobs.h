@@ -0,0 +1,44 @@
+/* header auto-generated by pidl */
+
+#ifndef _PIDL_HEADER_frsblobs
+#define _PIDL_HEADER_frsblobs
+
+#include <stdint.h>
+
+#include "libcli/util/ntstatus.h"
+
+#include "librpc/gen_ndr/misc.h"
+#include "librpc/gen_ndr/security.h"
+#include "librpc/gen_ndr/frsrpc.h"
+#include "librpc/gen_ndr/bkupblobs.h"
+#include "librpc/gen_ndr/fscc.h"
+#ifndef _HEADER_frsblobs
+#define _HEADER_frsblobs
+
+
+struct decode_nt_backup_file {
+	struct {
+		struct bkup_NTBackupFile file;
+	} in;
+
+};
+
+
+struct decode_frsrpc_StageHeader {
+	struct {
+		struct frsrpc_StageHeader header;
+		struct bkup_NTBackupFile data;
+	} in;
+
+};
+
+
+struct decode_FileNetworkOpenInformation {
+	struct {
+		struct fscc_FileNetworkOpenInformation data;
+	} in;
+
+};
+
+#endif /* _HEADER_frsblobs */
+#endif /* _PIDL_HEADER_frsblobs */
@@ -0,0 +1,37 @@
+/* header auto-generated by pidl */
+
+#ifndef _PIDL_HEADER_fsrvp_state
+#define _PIDL_HEADER_fsrvp_state
+
+#include <stdint.h>
+
+#include "libcli/util/ntstatus.h"
+
+#ifndef _HEADER_fsrvp_state
+#define _HEADER_fsrvp_state
+
+#define FSRVP_STATE_DB_VERSION	( 1 )
+struct fsrvp_state_smap {
+	const char * share_name;/* [flag(LIBNDR_FLAG_STR_UTF8|LIBNDR_FLAG_STR_NULLTERM)] */
+	const char * sc_share_name;/* [flag(LIBNDR_FLAG_STR_UTF8|LIBNDR_FLAG_STR_NULLTERM)] */
+	const char * sc_share_comment;/* [flag(LIBNDR_FLAG_STR_UTF8|LIBNDR_FLAG_STR_NULLTERM)] */
+	uint32_t is_exposed;
+}/* [public] */;
+
+struct fsrvp_state_sc {
+	const char * id_str;/* [flag(LIBNDR_FLAG_STR_UTF8|LIBNDR_FLAG_STR_NULLTERM)] */
+	const char * volume_name;/* [flag(LIBNDR_FLAG_STR_UTF8|LIBNDR_FLAG_STR_NULLTERM)] */
+	const char * sc_path;/* [flag(LIBNDR_FLAG_STR_UTF8|LIBNDR_FLAG_STR_NULLTERM)] */
+	time_t create_ts;
+	int32_t smaps_count;
+}/* [public] */;
+
+struct fsrvp_state_sc_set {
+	const char * id_str;/* [flag(LIBNDR_FLAG_STR_UTF8|LIBNDR_FLAG_STR_NULLTERM)] */
+	int32_t state;
+	int32_t context;
+	int32_t scs_count;
+}/* [public] */;
+
+#endif /* _HEADER_fsrvp_state */
+#endif /* _PIDL_HEADER_fsrvp_state */
@@ -0,0 +1,60 @@
+/* header auto-generated by pidl */
+
+#ifndef _PIDL_HEADER_idmap
+#define _PIDL_HEADER_idmap
+
+#include <stdint.h>
+
+#include "libcli/util/ntstatus.h"
+
+#include "librpc/gen_ndr/security.h"
+#ifndef _HEADER_idmap
+#define _HEADER_idmap
+
+enum id_type
+#ifndef USE_UINT_ENUMS
+ {
+	ID_TYPE_NOT_SPECIFIED,
+	ID_TYPE_UID,
+	ID_TYPE_GID,
+	ID_TYPE_BOTH
+}
+#else
+ { __do_not_use_enum_id_type=0x7FFFFFFF}
+#define ID_TYPE_NOT_SPECIFIED ( 0 )
+#define ID_TYPE_UID ( 1 )
+#define ID_TYPE_GID ( 2 )
+#define ID_TYPE_BOTH ( 3 )
+#endif
+;
+
+struct unixid {
+	uint32_t id;
+	enum id_type type;
+}/* [public] */;
+
+enum id_mapping
+#ifndef USE_UINT_ENUMS
+ {
+	ID_UNKNOWN,
+	ID_MAPPED,
+	ID_UNMAPPED,
+	ID_EXPIRED
+}
+#else
+ { __do_not_use_enum_id_mapping=0x7FFFFFFF}
+#define ID_UNKNOWN ( 0 )
+#define ID_MAPPED ( 1 )
+#define ID_UNMAPPED ( 2 )
+#define ID_EXPIRED ( 3 )
+#endif
+;
+
+struct id_map {
+	struct dom_sid *sid;/* [unique] */
+	struct unixid xid;
+	enum id_mapping status;
+}/* [public] */;
+
+#endif /* _HEADER_idmap */
+#endif /* _PIDL_HEADER_idmap */
@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/bkupblobs.h"
+#ifndef _HEADER_RPC_bkup
+#define _HEADER_RPC_bkup
+
+#endif /* _HEADER_RPC_bkup */
@@ -0,0 +1,18 @@
+/* header auto-generated by pidl */
+
+#include "librpc/ndr/libndr.h"
+#include "bin/default/librpc/gen_ndr/dbgidl.h"
+
+#ifndef _HEADER_NDR_dbgidl
+#define _HEADER_NDR_dbgidl
+
+#define NDR_DBGIDL_UUID "1d55b526-c137-46c5-ab79-638f2a68e869"
+#define NDR_DBGIDL_VERSION 1.0
+#define NDR_DBGIDL_NAME "dbgidl"
+#define NDR_DBGIDL_HELPSTRING "Remote IDL debugger"
+extern const struct ndr_interface_table ndr_table_dbgidl;
+#define NDR_DUMMY_DBGIDL (0x00)
+
+#define NDR_DBGIDL_CALL_COUNT (1)
+void ndr_print_dummy_dbgidl(struct ndr_print *ndr, const char *name, int flags, const struct dummy_dbgidl *r);
+#endif /* _HEADER_NDR_dbgidl */
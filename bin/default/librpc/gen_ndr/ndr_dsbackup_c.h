@@ -0,0 +1,14 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/dsbackup.h"
+#ifndef _HEADER_RPC_ad_backup
+#define _HEADER_RPC_ad_backup
+
+extern const struct ndr_interface_table ndr_table_ad_backup;
+
+#endif /* _HEADER_RPC_ad_backup */
+#ifndef _HEADER_RPC_ad_restore
+#define _HEADER_RPC_ad_restore
+
+extern const struct ndr_interface_table ndr_table_ad_restore;
+
+#endif /* _HEADER_RPC_ad_restore */
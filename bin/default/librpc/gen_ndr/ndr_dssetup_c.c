@@ -0,0 +1,235 @@
+/* client functions auto-generated by pidl */
+
+#include "includes.h"
+#include <tevent.h>
+#include "lib/util/tevent_ntstatus.h"
+#include "bin/default/librpc/gen_ndr/ndr_dssetup.h"
+#include "bin/default/librpc/gen_ndr/ndr_dssetup_c.h"
+
+/* dssetup - client functions generated by pidl */
+
+struct dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r_state {
+	TALLOC_CTX *out_mem_ctx;
+};
+
+static void dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r_done(struct tevent_req *subreq);
+
+struct tevent_req *dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r_send(TALLOC_CTX *mem_ctx,
+	struct tevent_context *ev,
+	struct dcerpc_binding_handle *h,
+	struct dssetup_DsRoleGetPrimaryDomainInformation *r)
+{
+	struct tevent_req *req;
+	struct dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r_state *state;
+	struct tevent_req *subreq;
+
+	req = tevent_req_create(mem_ctx, &state,
+				struct dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r_state);
+	if (req == NULL) {
+		return NULL;
+	}
+
+	state->out_mem_ctx = talloc_new(state);
+	if (tevent_req_nomem(state->out_mem_ctx, req)) {
+		return tevent_req_post(req, ev);
+	}
+
+	subreq = dcerpc_binding_handle_call_send(state, ev, h,
+			NULL, &ndr_table_dssetup,
+			NDR_DSSETUP_DSROLEGETPRIMARYDOMAININFORMATION, state->out_mem_ctx, r);
+	if (tevent_req_nomem(subreq, req)) {
+		return tevent_req_post(req, ev);
+	}
+	tevent_req_set_callback(subreq, dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r_done, req);
+
+	return req;
+}
+
+static void dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req =
+		tevent_req_callback_data(subreq,
+		struct tevent_req);
+	NTSTATUS status;
+
+	status = dcerpc_binding_handle_call_recv(subreq);
+	TALLOC_FREE(subreq);
+	if (tevent_req_nterror(req, status)) {
+		return;
+	}
+
+	tevent_req_done(req);
+}
+
+NTSTATUS dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r_recv(struct tevent_req *req, TALLOC_CTX *mem_ctx)
+{
+	struct dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r_state *state =
+		tevent_req_data(req,
+		struct dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status)) {
+		tevent_req_received(req);
+		return status;
+	}
+
+	talloc_steal(mem_ctx, state->out_mem_ctx);
+
+	tevent_req_received(req);
+	return NT_STATUS_OK;
+}
+
+NTSTATUS dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r(struct dcerpc_binding_handle *h, TALLOC_CTX *mem_ctx, struct dssetup_DsRoleGetPrimaryDomainInformation *r)
+{
+	NTSTATUS status;
+
+	status = dcerpc_binding_handle_call(h,
+			NULL, &ndr_table_dssetup,
+			NDR_DSSETUP_DSROLEGETPRIMARYDOMAININFORMATION, mem_ctx, r);
+
+	return status;
+}
+
+struct dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_state {
+	struct dssetup_DsRoleGetPrimaryDomainInformation orig;
+	struct dssetup_DsRoleGetPrimaryDomainInformation tmp;
+	TALLOC_CTX *out_mem_ctx;
+};
+
+static void dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_done(struct tevent_req *subreq);
+
+struct tevent_req *dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_send(TALLOC_CTX *mem_ctx,
+									 struct tevent_context *ev,
+									 struct dcerpc_binding_handle *h,
+									 enum dssetup_DsRoleInfoLevel _level /* [in]  */,
+									 union dssetup_DsRoleInfo *_info /* [out] [switch_is(level),unique] */)
+{
+	struct tevent_req *req;
+	struct dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_state *state;
+	struct tevent_req *subreq;
+
+	req = tevent_req_create(mem_ctx, &state,
+				struct dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_state);
+	if (req == NULL) {
+		return NULL;
+	}
+	state->out_mem_ctx = NULL;
+
+	/* In parameters */
+	state->orig.in.level = _level;
+
+	/* Out parameters */
+	state->orig.out.info = _info;
+
+	/* Result */
+	ZERO_STRUCT(state->orig.out.result);
+
+	state->out_mem_ctx = talloc_named_const(state, 0,
+			     "dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_out_memory");
+	if (tevent_req_nomem(state->out_mem_ctx, req)) {
+		return tevent_req_post(req, ev);
+	}
+
+	/* make a temporary copy, that we pass to the dispatch function */
+	state->tmp = state->orig;
+
+	subreq = dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r_send(state, ev, h, &state->tmp);
+	if (tevent_req_nomem(subreq, req)) {
+		return tevent_req_post(req, ev);
+	}
+	tevent_req_set_callback(subreq, dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_done, req);
+	return req;
+}
+
+static void dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(
+		subreq, struct tevent_req);
+	struct dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_state *state = tevent_req_data(
+		req, struct dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_state);
+	NTSTATUS status;
+	TALLOC_CTX *mem_ctx;
+
+	if (state->out_mem_ctx) {
+		mem_ctx = state->out_mem_ctx;
+	} else {
+		mem_ctx = state;
+	}
+
+	status = dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r_recv(subreq, mem_ctx);
+	TALLOC_FREE(subreq);
+	if (tevent_req_nterror(req, status)) {
+		return;
+	}
+
+	/* Copy out parameters */
+	if (state->orig.out.info && state->tmp.out.info) {
+		*state->orig.out.info = *state->tmp.out.info;
+	}
+
+	/* Copy result */
+	state->orig.out.result = state->tmp.out.result;
+
+	/* Reset temporary structure */
+	ZERO_STRUCT(state->tmp);
+
+	tevent_req_done(req);
+}
+
+NTSTATUS dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_recv(struct tevent_req *req,
+							       TALLOC_CTX *mem_ctx,
+							       WERROR *result)
+{
+	struct dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_state *state = tevent_req_data(
+		req, struct dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status)) {
+		tevent_req_received(req);
+		return status;
+	}
+
+	/* Steal possible out parameters to the callers context */
+	talloc_steal(mem_ctx, state->out_mem_ctx);
+
+	/* Return result */
+	*result = state->orig.out.result;
+
+	tevent_req_received(req);
+	return NT_STATUS_OK;
+}
+
+NTSTATUS dcerpc_dssetup_DsRoleGetPrimaryDomainInformation(struct dcerpc_binding_handle *h,
+							  TALLOC_CTX *mem_ctx,
+							  enum dssetup_DsRoleInfoLevel _level /* [in]  */,
+							  union dssetup_DsRoleInfo *_info /* [out] [switch_is(level),unique] */,
+							  WERROR *result)
+{
+	struct dssetup_DsRoleGetPrimaryDomainInformation r;
+	NTSTATUS status;
+
+	/* In parameters */
+	r.in.level = _level;
+
+	/* Out parameters */
+	r.out.info = _info;
+
+	/* Result */
+	ZERO_STRUCT(r.out.result);
+
+	status = dcerpc_dssetup_DsRoleGetPrimaryDomainInformation_r(h, mem_ctx, &r);
+	if (!NT_STATUS_IS_OK(status)) {
+		return status;
+	}
+
+	/* Return variables */
+	if (_info && r.out.info) {
+		*_info = *r.out.info;
+	}
+
+	/* Return result */
+	*result = r.out.result;
+
+	return NT_STATUS_OK;
+}
+
@@ -0,0 +1,10 @@
+/* client functions auto-generated by pidl */
+
+#include "includes.h"
+#include <tevent.h>
+#include "lib/util/tevent_ntstatus.h"
+#include "bin/default/librpc/gen_ndr/ndr_file_id.h"
+#include "bin/default/librpc/gen_ndr/ndr_file_id_c.h"
+
+/* file_id - client functions generated by pidl */
+
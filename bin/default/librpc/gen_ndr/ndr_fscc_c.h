@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/fscc.h"
+#ifndef _HEADER_RPC_fscc
+#define _HEADER_RPC_fscc
+
+#endif /* _HEADER_RPC_fscc */
@@ -0,0 +1,6 @@
+/* server functions auto-generated by pidl */
+#include "bin/default/librpc/gen_ndr/ndr_named_pipe_auth.h"
+#include <util/debug.h>
+
+NTSTATUS dcerpc_server_named_pipe_auth_init(TALLOC_CTX *);
+
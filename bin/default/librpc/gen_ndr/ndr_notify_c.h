@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/notify.h"
+#ifndef _HEADER_RPC_notify
+#define _HEADER_RPC_notify
+
+#endif /* _HEADER_RPC_notify */
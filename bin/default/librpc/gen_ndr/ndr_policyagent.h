@@ -0,0 +1,18 @@
+/* header auto-generated by pidl */
+
+#include "librpc/ndr/libndr.h"
+#include "bin/default/librpc/gen_ndr/policyagent.h"
+
+#ifndef _HEADER_NDR_policyagent
+#define _HEADER_NDR_policyagent
+
+#define NDR_POLICYAGENT_UUID "d335b8f6-cb31-11d0-b0f9-006097ba4e54"
+#define NDR_POLICYAGENT_VERSION 327681
+#define NDR_POLICYAGENT_NAME "policyagent"
+#define NDR_POLICYAGENT_HELPSTRING "IPSec Policy Agent"
+extern const struct ndr_interface_table ndr_table_policyagent;
+#define NDR_POLICYAGENT_DUMMY (0x00)
+
+#define NDR_POLICYAGENT_CALL_COUNT (1)
+void ndr_print_policyagent_Dummy(struct ndr_print *ndr, const char *name, int flags, const struct policyagent_Dummy *r);
+#endif /* _HEADER_NDR_policyagent */
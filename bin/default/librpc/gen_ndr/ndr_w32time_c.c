@@ -0,0 +1,10 @@
+/* client functions auto-generated by pidl */
+
+#include "includes.h"
+#include <tevent.h>
+#include "lib/util/tevent_ntstatus.h"
+#include "bin/default/librpc/gen_ndr/ndr_w32time.h"
+#include "bin/default/librpc/gen_ndr/ndr_w32time_c.h"
+
+/* w32time - client functions generated by pidl */
+